@@ -12,6 +12,7 @@
 #include <set>
 #include <numeric>
 #include <chrono>
+#include <cstdint>
 namespace std
 {
 
@@ -29,7 +30,9 @@ namespace std
         map<int, vector<int>> adjList;        // Adjacency list representation of the graph
         vector<vector<int>> permutationsList; // List to store permutations
         vector<vector<int>> dfsPaths;         // List to store DFS paths
-        int DFScount = 0;
+        vector<uint64_t> adjBits;             // Adjacency rows as bitsets, indexed by position in adjList
+        vector<uint64_t> inBits;              // In-neighbor rows as bitsets, bit u of row v is set for an edge u->v
+        long long DFScount = 0;
         int PERMcount = 0;
         bool storePaths = false;
 
@@ -105,6 +108,134 @@ namespace std
             }
         }
 
+        /**
+         * Counts the set bits in a 64-bit word.
+         *
+         * @param word The word to count.
+         * @return The number of set bits.
+         */
+        static int popcount64(uint64_t word)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_popcountll(word);
+#else
+            int count = 0;
+            for (; word != 0; word &= word - 1)
+            {
+                count++;
+            }
+            return count;
+#endif
+        }
+
+        /**
+         * Returns the index of the lowest set bit in a non-zero 64-bit word.
+         *
+         * @param word The word to scan, must not be zero.
+         * @return The index of the lowest set bit.
+         */
+        static int lowestBit64(uint64_t word)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_ctzll(word);
+#else
+            int index = 0;
+            while ((word & 1) == 0)
+            {
+                word >>= 1;
+                index++;
+            }
+            return index;
+#endif
+        }
+
+        /**
+         * Builds the bitset representation of the adjacency list used by bitDepthFirstSearch.
+         *
+         * Vertices are renumbered by their position in adjList, so row i of adjBits holds the
+         * neighbors of the i-th vertex as set bits, and row i of inBits holds the vertices that
+         * have the i-th vertex as a neighbor. Each row is a single word, so this only applies to
+         * graphs with at most 64 vertices.
+         *
+         * @return True if the bitsets represent adjList exactly, false if adjList has more than 64
+         *         vertices or has parallel edges (the same neighbor listed more than once), which
+         *         bitsets cannot count separately.
+         */
+        bool buildAdjBits()
+        {
+            int n = adjList.size();
+            if (n > 64)
+            {
+                return false;
+            }
+
+            map<int, int> index;
+            int k = 0;
+            for (auto &i : adjList)
+            {
+                index[i.first] = k++;
+            }
+
+            adjBits.assign(n, 0);
+            inBits.assign(n, 0);
+            for (auto &i : adjList)
+            {
+                int u = index[i.first];
+                for (int neighbor : i.second)
+                {
+                    auto it = index.find(neighbor);
+                    if (it != index.end())
+                    {
+                        int v = it->second;
+                        if (adjBits[u] & (uint64_t(1) << v))
+                        {
+                            return false;
+                        }
+                        adjBits[u] |= uint64_t(1) << v;
+                        inBits[v] |= uint64_t(1) << u;
+                    }
+                }
+            }
+            return true;
+        }
+
+        /**
+         * Counts the cycle paths through a given node using the bitset adjacency rows.
+         *
+         * The legal next vertices are adjBits[node] & ~visited, and a next vertex closes a cycle
+         * when it has an edge back to origin, i.e. its bit is also set in inBits[origin]. Closing
+         * cycles of all next vertices are counted at once with popcount, and next vertices with no
+         * unvisited neighbor are not descended into, since they cannot extend the path any further.
+         *
+         * @param node The current node, as an index into adjBits.
+         * @param origin The starting node of the search, as an index into adjBits.
+         * @param visited The nodes in the current path, including node, as a bitset.
+         * @param depth The number of nodes in the current path, including node.
+         * @return The number of cycle paths found below node.
+         */
+        long long bitDepthFirstSearch(int node, int origin, uint64_t visited, int depth)
+        {
+            uint64_t candidates = adjBits[node] & ~visited;
+            long long count = 0;
+
+            if (depth >= 2) // The next vertex makes the path long enough to form a cycle
+            {
+                count += popcount64(candidates & inBits[origin]);
+            }
+            while (candidates != 0)
+            {
+                int neighbor = lowestBit64(candidates);
+                candidates &= candidates - 1;
+
+                uint64_t nextVisited = visited | (uint64_t(1) << neighbor);
+                if ((adjBits[neighbor] & ~nextVisited) != 0) // Only descend if the path can still be extended
+                {
+                    count += bitDepthFirstSearch(neighbor, origin, nextVisited, depth + 1);
+                }
+            }
+            return count;
+        }
+
         /**
          * Generates optimized permutations for subsets of nodes.
          *
@@ -313,10 +444,20 @@ namespace std
             map<int, vector<int>> adjListCopy = getAdjList();
             vector<vector<int>> dfsPaths;
 
-            for (auto i : adjListCopy)
+            if (storePaths == true || !buildAdjBits()) // Large graphs and parallel edges use the path-based search
             {
-                int origin = i.first;
-                depthFirstSearch(origin, origin, {}, -1);
+                for (auto i : adjListCopy)
+                {
+                    int origin = i.first;
+                    depthFirstSearch(origin, origin, {}, -1);
+                }
+            }
+            else
+            {
+                for (int origin = 0; origin < (int)adjBits.size(); origin++)
+                {
+                    DFScount += bitDepthFirstSearch(origin, origin, uint64_t(1) << origin, 1);
+                }
             }
             auto end = Clock::now();                                                            // Finalizar o ponto de tempo após a operação
             auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start); // Calcular a duração em milissegundos